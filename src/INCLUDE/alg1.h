@@ -26,19 +26,46 @@
 #ifndef __ALG1_H_
 #define __ALG1_H_
 
-#include "types.h"
+#include "TYPES.H"
 
 #define PLL_ADDR 	0x69
 #define CMD		0x00
 
+/* SMBus protocols supported by the PLL */
+#define PLL_SMB_BLOCK	0x01
+#define PLL_SMB_BYTE	0x02
+#define PLL_SMB_WORD	0x04
+
+/* FS keys have up to 6 bits, so a table has at most PLL_KEYS entries */
+#define PLL_KEYS	64
+#define PLL_DIV_MAX	15
+#define PLL_NO_IDX	0xFF
+
 typedef struct
 {
-	float fsb;
-	float pci;
+	u32 fsb;			// kHz
+	u32 pci;			// kHz
 	u8 fsb_key;
 	int pci_div;
 } fsb_rec;
 
+/* M/N programming of the VCO, used by alg2:
+   VCO = MN_REF_HZ * (N + n_off) / (M + m_off) */
+typedef struct
+{
+	int en_byte;			// M/N programming enable, -1 if none
+	int en_bit;
+	int m_byte;			// M in the low m_bits
+	int m_bits;
+	int n_byte;			// N bits 7:0
+	int n8_byte;			// N bit 8, -1 if none
+	int n8_bit;
+	int n9_byte;			// N bit 9, -1 if none
+	int n9_bit;
+	int n_off;
+	int m_off;
+} mn_data;
+
 typedef struct
 {
 	char *name;			// FNAME
@@ -70,16 +97,39 @@ typedef struct
 	bool lfs_inv;			// LFS_INV
 	bool can_test;			// CAN_TEST
 	bool can_read;			// CAN_READ
+	int smb_caps;			// SMB_CAPS
+	u8 emu_cmd;			// EMU_CMD
+	const u8 *key_idx;		// Table index of each FS key, PLL_NO_IDX if none
+	const u8 *div_idx;		// Table indexes by PCI divider, then FSB
+	const u8 *div_first;		// Start of each PCI divider in div_idx
+	mn_data mn;			// M/N programming
+	const u8 *def_reg;		// Power-on register image
+	const u8 *fp_mask;		// Bits of def_reg a read is expected to match
+	const u8 *id_mask;		// Read-only ID bits in def_reg, which must match
 } pll_data;
 
-int alg1_set_fsb(const pll_data *pll, float fsb, float pci, bool test);
+int alg1_set_fsb(const pll_data *pll, u32 fsb, u32 pci, bool test);
+
+int alg1_get_fsb(const pll_data *pll, u32 *fsb, u32 *pci, u8 *fsb_key, int *pci_div);
 
-int alg1_get_fsb(const pll_data *pll, float *fsb, float *pci, u8 *fsb_key, int *pci_div);
+int alg1_commit(const pll_data *pll, bool test);
 
-int alg1_get_supp_fsb(const pll_data *pll, int idx, float *fsb, float *pci, u8 *fsb_key, int *pci_div);
+int alg1_read_all(const pll_data *pll, bool test);
+
+bool alg1_has_regs(const pll_data *pll, int len);
+
+int alg1_get_supp_fsb(const pll_data *pll, int idx, u32 *fsb, u32 *pci, u8 *fsb_key, int *pci_div);
 
 int alg1_get_supp_fsb_size(const pll_data *pll);
 
+int alg1_get_div_size(const pll_data *pll, int pci_div);
+
+int alg1_get_div_idx(const pll_data *pll, int pci_div, int n);
+
+int alg1_find_fsb(const pll_data *pll, int pci_div, u32 fsb);
+
+int alg1_match(const pll_data *pll, const u8 *buf, int len);
+
 bool alg1_can_test(const pll_data *pll);
 
 bool alg1_can_read(const pll_data *pll);
@@ -0,0 +1,55 @@
+/*******************************************************************************
+
+  alg2.h: M/N programming of the PLL VCO between table FSB
+  VIAFSB - DOS FSB Utility For VIA Chipsets
+
+  Author: Enaiel <enaiel@gmail.com> (c) 2022
+
+  This program is free software; you can redistribute it and/or modify it
+  under the terms and conditions of the GNU General Public License,
+  version 2, as published by the Free Software Foundation.
+
+  This program is distributed in the hope it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc.,
+  51 Franklin St - Fifth Floor, Boston, MA 02110-1301 USA.
+
+  The full GNU General Public License is included in this distribution in
+  the file called "COPYING".
+
+*******************************************************************************/
+
+#ifndef __ALG2_H_
+#define __ALG2_H_
+
+#include "TYPES.H"
+#include "alg1.h"
+
+#define MN_REF_HZ	14318180	/* Reference crystal */
+
+/* M/N moves the FSB at most this far from the table FSB whose output
+   dividers are in effect. That keeps the VCO near a frequency the PLL was
+   made for, and the output divider, taken as the nearest whole ratio of
+   VCO to table FSB, unambiguous up to MN_DIV_MAX. */
+#define MN_SPAN_PCT	5
+#define MN_DIV_MAX	(100 / (2 * MN_SPAN_PCT) - 1)
+
+bool alg2_can_mn(const pll_data *pll);
+
+bool alg2_in_span(const pll_data *pll, int idx, u32 fsb);
+
+u32 alg2_get_pci(const pll_data *pll, int idx, u32 fsb);
+
+u32 alg2_get_div(const pll_data *pll, int idx);
+
+u32 alg2_find_fsb(const pll_data *pll, int idx, u32 fsb, u32 div);
+
+int alg2_get_fsb(const pll_data *pll, u32 *fsb, u32 *pci, u8 *fsb_key, int *pci_div, bool test);
+
+int alg2_set_fsb(const pll_data *pll, int idx, u32 *fsb, u32 *pci, bool test);
+
+#endif //__ALG2_H_